@@ -0,0 +1,11 @@
+#ifdef DEF1
+#define X 1
+#endif
+#ifdef DEF2
+#undef X
+#define X 2
+#endif
+
+#if X == 1
+int a;
+#endif